@@ -0,0 +1,605 @@
+/**
+ * Author: AnormalDog (https://github.com/AnormalDog)
+ * Copyright (c) 2025 AnormalDog
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ *
+ * benchmark file, measures the throughput of every RuntimeBitset operation
+ *   and compares it against std::bitset, std::vector<bool> and boost::dynamic_bitset
+ */
+
+// g++ -O2 -DNDEBUG -I lib/ lib/RuntimeBitset/RuntimeBitset.cpp lib/RuntimeBitset/SetAlgebra.cpp bench/benchmark.cpp -lbenchmark -lpthread
+// ./a.out --benchmark_out=bench_output.json --benchmark_out_format=json
+
+#include "RuntimeBitset/RuntimeBitset.hpp"
+#include "RuntimeBitset/SetAlgebra.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if __has_include(<boost/dynamic_bitset.hpp>)
+#include <boost/dynamic_bitset.hpp>
+#define RUNTIMEBITSET_BENCH_BOOST 1
+#endif
+
+using namespace DynBitset;
+
+namespace {
+
+constexpr std::size_t MIN_BITS = 64;
+constexpr std::size_t MAX_BITS = std::size_t(1) << 30; // 1 Gbit
+constexpr std::size_t MAX_STRING_BITS = std::size_t(1) << 24; // to_string and parsing are per bit, cap them
+constexpr std::size_t RANDOM_POSITIONS = 4096; // power of 2, indexed with a mask
+
+// 64, 4K, 256K, 16M, 1G bits
+void allSizes(benchmark::internal::Benchmark* t_bench) {
+  for (std::size_t i = MIN_BITS; i <= MAX_BITS; i *= 64) t_bench->Arg(static_cast<int64_t>(i));
+}
+
+void stringSizes(benchmark::internal::Benchmark* t_bench) {
+  for (std::size_t i = MIN_BITS; i <= MAX_STRING_BITS; i *= 64) t_bench->Arg(static_cast<int64_t>(i));
+}
+
+std::vector<std::size_t> randomPositions(const std::size_t t_size) {
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<std::size_t> dist(0, t_size - 1);
+  std::vector<std::size_t> positions(RANDOM_POSITIONS);
+  for (std::size_t& i : positions) i = dist(gen);
+  return positions;
+}
+
+std::string randomString(const std::size_t t_size) {
+  std::mt19937_64 gen(7);
+  std::string aux(t_size, '0');
+  for (char& c : aux) c = (gen() & 1) ? '1' : '0';
+  return aux;
+}
+
+// Bytes touched by an operation over t_size bits, used by SetBytesProcessed
+int64_t bytesOf(const std::size_t t_size) {
+  return static_cast<int64_t>((t_size + 7) / 8);
+}
+
+// ADAPTERS
+// Give the same interface to every runtime sized container, so each benchmark is written once
+
+struct RuntimeAdapter {
+  using type = RuntimeBitset;
+  static type make(const std::size_t t_size) {return RuntimeBitset(t_size);}
+  static type fromString(const std::string& t_string) {return RuntimeBitset(t_string);}
+  static void set(type& t_bits, const std::size_t t_pos) {t_bits.set(t_pos);}
+  static bool test(const type& t_bits, const std::size_t t_pos) {return t_bits.test(t_pos);}
+  static std::size_t count(const type& t_bits) {return t_bits.count();}
+  static type bitAnd(const type& t_1, const type& t_2) {return t_1 & t_2;}
+  static type bitOr(const type& t_1, const type& t_2) {return t_1 | t_2;}
+  static type bitXor(const type& t_1, const type& t_2) {return t_1 ^ t_2;}
+  static type shiftLeft(const type& t_bits, const std::size_t t_pos) {return t_bits << t_pos;}
+  static type shiftRight(const type& t_bits, const std::size_t t_pos) {return t_bits >> t_pos;}
+  static std::string toString(const type& t_bits) {return t_bits.to_string();}
+};
+
+// std::vector<bool> has no bitwise operators, use the loop a caller would write
+struct VectorBoolAdapter {
+  using type = std::vector<bool>;
+  static type make(const std::size_t t_size) {return type(t_size, false);}
+  static void set(type& t_bits, const std::size_t t_pos) {t_bits[t_pos] = true;}
+  static bool test(const type& t_bits, const std::size_t t_pos) {return t_bits[t_pos];}
+  static std::size_t count(const type& t_bits) {return static_cast<std::size_t>(std::count(t_bits.begin(), t_bits.end(), true));}
+  static type bitAnd(const type& t_1, const type& t_2) {
+    type aux(t_1.size());
+    for (std::size_t i = 0; i < aux.size(); ++i) aux[i] = t_1[i] && t_2[i];
+    return aux;
+  }
+  static type bitOr(const type& t_1, const type& t_2) {
+    type aux(t_1.size());
+    for (std::size_t i = 0; i < aux.size(); ++i) aux[i] = t_1[i] || t_2[i];
+    return aux;
+  }
+  static type bitXor(const type& t_1, const type& t_2) {
+    type aux(t_1.size());
+    for (std::size_t i = 0; i < aux.size(); ++i) aux[i] = t_1[i] != t_2[i];
+    return aux;
+  }
+};
+
+#ifdef RUNTIMEBITSET_BENCH_BOOST
+struct BoostAdapter {
+  using type = boost::dynamic_bitset<std::size_t>;
+  static type make(const std::size_t t_size) {return type(t_size);}
+  static type fromString(const std::string& t_string) {return type(t_string);}
+  static void set(type& t_bits, const std::size_t t_pos) {t_bits.set(t_pos);}
+  static bool test(const type& t_bits, const std::size_t t_pos) {return t_bits.test(t_pos);}
+  static std::size_t count(const type& t_bits) {return t_bits.count();}
+  static type bitAnd(const type& t_1, const type& t_2) {return t_1 & t_2;}
+  static type bitOr(const type& t_1, const type& t_2) {return t_1 | t_2;}
+  static type bitXor(const type& t_1, const type& t_2) {return t_1 ^ t_2;}
+  static type shiftLeft(const type& t_bits, const std::size_t t_pos) {return t_bits << t_pos;}
+  static type shiftRight(const type& t_bits, const std::size_t t_pos) {return t_bits >> t_pos;}
+  static std::string toString(const type& t_bits) {
+    std::string aux;
+    boost::to_string(t_bits, aux);
+    return aux;
+  }
+};
+#endif
+
+// Half of the bits set, so the binary operations and count don´t work over trivial data
+template <typename Adapter>
+typename Adapter::type makeFilled(const std::size_t t_size, const std::size_t t_seed) {
+  typename Adapter::type aux = Adapter::make(t_size);
+  std::mt19937_64 gen(t_seed);
+  for (std::size_t i = 0; i < t_size; i += 2) {
+    if (gen() & 1) Adapter::set(aux, i);
+  }
+  return aux;
+}
+
+// RUNTIME SIZED BENCHMARKS
+
+template <typename Adapter>
+void BM_Construct(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    typename Adapter::type aux = Adapter::make(size);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size));
+}
+
+template <typename Adapter>
+void BM_Copy(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const typename Adapter::type original = makeFilled<Adapter>(size, 1);
+  for (auto _ : state) {
+    typename Adapter::type aux(original);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size));
+}
+
+template <typename Adapter>
+void BM_Move(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  typename Adapter::type first = Adapter::make(size);
+  for (auto _ : state) {
+    typename Adapter::type second(std::move(first));
+    first = std::move(second);
+    benchmark::DoNotOptimize(first);
+  }
+}
+
+template <typename Adapter>
+void BM_RandomTest(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const typename Adapter::type bits = makeFilled<Adapter>(size, 1);
+  const std::vector<std::size_t> positions = randomPositions(size);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Adapter::test(bits, positions[i++ & (RANDOM_POSITIONS - 1)]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Adapter>
+void BM_RandomSet(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  typename Adapter::type bits = Adapter::make(size);
+  const std::vector<std::size_t> positions = randomPositions(size);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    Adapter::set(bits, positions[i++ & (RANDOM_POSITIONS - 1)]);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Adapter>
+void BM_Count(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const typename Adapter::type bits = makeFilled<Adapter>(size, 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Adapter::count(bits));
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size));
+}
+
+template <typename Adapter>
+void BM_And(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const typename Adapter::type bits1 = makeFilled<Adapter>(size, 1);
+  const typename Adapter::type bits2 = makeFilled<Adapter>(size, 2);
+  for (auto _ : state) {
+    typename Adapter::type aux = Adapter::bitAnd(bits1, bits2);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size) * 2);
+}
+
+template <typename Adapter>
+void BM_Or(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const typename Adapter::type bits1 = makeFilled<Adapter>(size, 1);
+  const typename Adapter::type bits2 = makeFilled<Adapter>(size, 2);
+  for (auto _ : state) {
+    typename Adapter::type aux = Adapter::bitOr(bits1, bits2);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size) * 2);
+}
+
+template <typename Adapter>
+void BM_Xor(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const typename Adapter::type bits1 = makeFilled<Adapter>(size, 1);
+  const typename Adapter::type bits2 = makeFilled<Adapter>(size, 2);
+  for (auto _ : state) {
+    typename Adapter::type aux = Adapter::bitXor(bits1, bits2);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size) * 2);
+}
+
+// Shift by a position that is not a multiple of the block size, so the carry between blocks is measured
+template <typename Adapter>
+void BM_ShiftLeft(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const typename Adapter::type bits = makeFilled<Adapter>(size, 1);
+  for (auto _ : state) {
+    typename Adapter::type aux = Adapter::shiftLeft(bits, 37);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size));
+}
+
+template <typename Adapter>
+void BM_ShiftRight(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const typename Adapter::type bits = makeFilled<Adapter>(size, 1);
+  for (auto _ : state) {
+    typename Adapter::type aux = Adapter::shiftRight(bits, 37);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size));
+}
+
+template <typename Adapter>
+void BM_ToString(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const typename Adapter::type bits = makeFilled<Adapter>(size, 1);
+  for (auto _ : state) {
+    std::string aux = Adapter::toString(bits);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+template <typename Adapter>
+void BM_FromString(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const std::string input = randomString(size);
+  for (auto _ : state) {
+    typename Adapter::type aux = Adapter::fromString(input);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+// STD::BITSET BENCHMARKS
+// The size is a template parameter, the bitsets live in the heap to avoid blowing the stack
+
+constexpr std::size_t MAX_STD_BITS = std::size_t(1) << 18; // operators return by value, on the stack
+
+template <std::size_t N>
+std::unique_ptr<std::bitset<N>> makeStdFilled(const std::size_t t_seed) {
+  std::unique_ptr<std::bitset<N>> aux(new std::bitset<N>());
+  std::mt19937_64 gen(t_seed);
+  for (std::size_t i = 0; i < N; i += 2) {
+    if (gen() & 1) aux->set(i);
+  }
+  return aux;
+}
+
+template <std::size_t N>
+void BM_StdConstruct(benchmark::State& state) {
+  for (auto _ : state) {
+    std::unique_ptr<std::bitset<N>> aux(new std::bitset<N>());
+    benchmark::DoNotOptimize(aux.get());
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(N));
+}
+
+template <std::size_t N>
+void BM_StdCopy(benchmark::State& state) {
+  const std::unique_ptr<std::bitset<N>> original = makeStdFilled<N>(1);
+  std::unique_ptr<std::bitset<N>> aux(new std::bitset<N>());
+  for (auto _ : state) {
+    *aux = *original;
+    benchmark::DoNotOptimize(aux.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(N));
+}
+
+template <std::size_t N>
+void BM_StdRandomTest(benchmark::State& state) {
+  const std::unique_ptr<std::bitset<N>> bits = makeStdFilled<N>(1);
+  const std::vector<std::size_t> positions = randomPositions(N);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bits->test(positions[i++ & (RANDOM_POSITIONS - 1)]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <std::size_t N>
+void BM_StdRandomSet(benchmark::State& state) {
+  std::unique_ptr<std::bitset<N>> bits(new std::bitset<N>());
+  const std::vector<std::size_t> positions = randomPositions(N);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    bits->set(positions[i++ & (RANDOM_POSITIONS - 1)]);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <std::size_t N>
+void BM_StdCount(benchmark::State& state) {
+  const std::unique_ptr<std::bitset<N>> bits = makeStdFilled<N>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bits->count());
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(N));
+}
+
+template <std::size_t N>
+void BM_StdAnd(benchmark::State& state) {
+  const std::unique_ptr<std::bitset<N>> bits1 = makeStdFilled<N>(1);
+  const std::unique_ptr<std::bitset<N>> bits2 = makeStdFilled<N>(2);
+  std::unique_ptr<std::bitset<N>> aux(new std::bitset<N>());
+  for (auto _ : state) {
+    *aux = *bits1 & *bits2;
+    benchmark::DoNotOptimize(aux.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(N) * 2);
+}
+
+template <std::size_t N>
+void BM_StdOr(benchmark::State& state) {
+  const std::unique_ptr<std::bitset<N>> bits1 = makeStdFilled<N>(1);
+  const std::unique_ptr<std::bitset<N>> bits2 = makeStdFilled<N>(2);
+  std::unique_ptr<std::bitset<N>> aux(new std::bitset<N>());
+  for (auto _ : state) {
+    *aux = *bits1 | *bits2;
+    benchmark::DoNotOptimize(aux.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(N) * 2);
+}
+
+template <std::size_t N>
+void BM_StdXor(benchmark::State& state) {
+  const std::unique_ptr<std::bitset<N>> bits1 = makeStdFilled<N>(1);
+  const std::unique_ptr<std::bitset<N>> bits2 = makeStdFilled<N>(2);
+  std::unique_ptr<std::bitset<N>> aux(new std::bitset<N>());
+  for (auto _ : state) {
+    *aux = *bits1 ^ *bits2;
+    benchmark::DoNotOptimize(aux.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(N) * 2);
+}
+
+template <std::size_t N>
+void BM_StdShiftLeft(benchmark::State& state) {
+  const std::unique_ptr<std::bitset<N>> bits = makeStdFilled<N>(1);
+  std::unique_ptr<std::bitset<N>> aux(new std::bitset<N>());
+  for (auto _ : state) {
+    *aux = *bits << 37;
+    benchmark::DoNotOptimize(aux.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(N));
+}
+
+template <std::size_t N>
+void BM_StdShiftRight(benchmark::State& state) {
+  const std::unique_ptr<std::bitset<N>> bits = makeStdFilled<N>(1);
+  std::unique_ptr<std::bitset<N>> aux(new std::bitset<N>());
+  for (auto _ : state) {
+    *aux = *bits >> 37;
+    benchmark::DoNotOptimize(aux.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(N));
+}
+
+template <std::size_t N>
+void BM_StdToString(benchmark::State& state) {
+  const std::unique_ptr<std::bitset<N>> bits = makeStdFilled<N>(1);
+  for (auto _ : state) {
+    std::string aux = bits->to_string();
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+template <std::size_t N>
+void BM_StdFromString(benchmark::State& state) {
+  const std::string input = randomString(N);
+  std::unique_ptr<std::bitset<N>> aux(new std::bitset<N>());
+  for (auto _ : state) {
+    *aux = std::bitset<N>(input);
+    benchmark::DoNotOptimize(aux.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+
+// SET ALGEBRA BENCHMARKS
+// Posting lists: SET_ALGEBRA_INPUTS random bitsets, chained operator& against the N-ary forms
+
+constexpr std::size_t SET_ALGEBRA_INPUTS = 16;
+constexpr std::size_t NEAREST_COLLECTION = 256;
+
+std::vector<RuntimeBitset> makeInputs(const std::size_t t_size, const std::size_t t_number) {
+  std::vector<RuntimeBitset> inputs;
+  for (std::size_t i = 0; i < t_number; ++i) inputs.push_back(makeFilled<RuntimeAdapter>(t_size, i + 1));
+  return inputs;
+}
+
+std::vector<const RuntimeBitset*> pointersTo(const std::vector<RuntimeBitset>& t_inputs) {
+  std::vector<const RuntimeBitset*> pointers;
+  for (const RuntimeBitset& i : t_inputs) pointers.push_back(&i);
+  return pointers;
+}
+
+void BM_IntersectChained(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const std::vector<RuntimeBitset> inputs = makeInputs(size, SET_ALGEBRA_INPUTS);
+  for (auto _ : state) {
+    RuntimeBitset aux = inputs[0];
+    for (std::size_t i = 1; i < inputs.size(); ++i) aux = aux & inputs[i];
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size) * static_cast<int64_t>(SET_ALGEBRA_INPUTS));
+}
+
+void BM_IntersectAll(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const std::vector<RuntimeBitset> inputs = makeInputs(size, SET_ALGEBRA_INPUTS);
+  const std::vector<const RuntimeBitset*> pointers = pointersTo(inputs);
+  for (auto _ : state) {
+    RuntimeBitset aux = SetAlgebra::intersect_all(pointers);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size) * static_cast<int64_t>(SET_ALGEBRA_INPUTS));
+}
+
+void BM_UnionAll(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const std::vector<RuntimeBitset> inputs = makeInputs(size, SET_ALGEBRA_INPUTS);
+  const std::vector<const RuntimeBitset*> pointers = pointersTo(inputs);
+  for (auto _ : state) {
+    RuntimeBitset aux = SetAlgebra::union_all(pointers);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size) * static_cast<int64_t>(SET_ALGEBRA_INPUTS));
+}
+
+void BM_Threshold(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const std::vector<RuntimeBitset> inputs = makeInputs(size, SET_ALGEBRA_INPUTS);
+  const std::vector<const RuntimeBitset*> pointers = pointersTo(inputs);
+  for (auto _ : state) {
+    RuntimeBitset aux = SetAlgebra::threshold(pointers, SET_ALGEBRA_INPUTS / 2);
+    benchmark::DoNotOptimize(aux);
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size) * static_cast<int64_t>(SET_ALGEBRA_INPUTS));
+}
+
+void BM_NearestHamming(benchmark::State& state) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0));
+  const std::vector<RuntimeBitset> collection = makeInputs(size, NEAREST_COLLECTION);
+  const std::vector<const RuntimeBitset*> pointers = pointersTo(collection);
+  const RuntimeBitset query = makeFilled<RuntimeAdapter>(size, NEAREST_COLLECTION + 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SetAlgebra::nearest_hamming(query, pointers, 10));
+  }
+  state.SetBytesProcessed(state.iterations() * bytesOf(size) * static_cast<int64_t>(NEAREST_COLLECTION));
+}
+
+// 64 bits to 16 Mbit, the inputs don´t fit in memory at 1 Gbit
+void setAlgebraSizes(benchmark::internal::Benchmark* t_bench) {
+  for (std::size_t i = MIN_BITS; i <= MAX_STRING_BITS; i *= 64) t_bench->Arg(static_cast<int64_t>(i));
+}
+
+// 64 bits to 256 Kbit, NEAREST_COLLECTION bitsets of each size
+void nearestSizes(benchmark::internal::Benchmark* t_bench) {
+  for (std::size_t i = MIN_BITS; i <= MAX_STRING_BITS / 64; i *= 64) t_bench->Arg(static_cast<int64_t>(i));
+}
+
+} // namespace
+
+// REGISTRATION
+// Names follow <operation>/<container>/<bits>, so the JSON output can be grouped by operation
+
+#define RUNTIMEBITSET_BENCH(func, adapter, name, sizes) \
+  BENCHMARK_TEMPLATE(func, adapter)->Name(#func "/" name)->Apply(sizes)
+
+RUNTIMEBITSET_BENCH(BM_Construct, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_Copy, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_Move, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_RandomTest, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_RandomSet, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_Count, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_And, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_Or, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_Xor, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_ShiftLeft, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_ShiftRight, RuntimeAdapter, "RuntimeBitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_ToString, RuntimeAdapter, "RuntimeBitset", stringSizes);
+RUNTIMEBITSET_BENCH(BM_FromString, RuntimeAdapter, "RuntimeBitset", stringSizes);
+
+RUNTIMEBITSET_BENCH(BM_Construct, VectorBoolAdapter, "vector<bool>", allSizes);
+RUNTIMEBITSET_BENCH(BM_Copy, VectorBoolAdapter, "vector<bool>", allSizes);
+RUNTIMEBITSET_BENCH(BM_Move, VectorBoolAdapter, "vector<bool>", allSizes);
+RUNTIMEBITSET_BENCH(BM_RandomTest, VectorBoolAdapter, "vector<bool>", allSizes);
+RUNTIMEBITSET_BENCH(BM_RandomSet, VectorBoolAdapter, "vector<bool>", allSizes);
+RUNTIMEBITSET_BENCH(BM_Count, VectorBoolAdapter, "vector<bool>", allSizes);
+RUNTIMEBITSET_BENCH(BM_And, VectorBoolAdapter, "vector<bool>", stringSizes); // bit by bit, too slow for 1 Gbit
+RUNTIMEBITSET_BENCH(BM_Or, VectorBoolAdapter, "vector<bool>", stringSizes);
+RUNTIMEBITSET_BENCH(BM_Xor, VectorBoolAdapter, "vector<bool>", stringSizes);
+
+#ifdef RUNTIMEBITSET_BENCH_BOOST
+RUNTIMEBITSET_BENCH(BM_Construct, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_Copy, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_Move, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_RandomTest, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_RandomSet, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_Count, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_And, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_Or, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_Xor, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_ShiftLeft, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_ShiftRight, BoostAdapter, "boost::dynamic_bitset", allSizes);
+RUNTIMEBITSET_BENCH(BM_ToString, BoostAdapter, "boost::dynamic_bitset", stringSizes);
+RUNTIMEBITSET_BENCH(BM_FromString, BoostAdapter, "boost::dynamic_bitset", stringSizes);
+#endif
+
+BENCHMARK(BM_IntersectChained)->Name("BM_IntersectChained/RuntimeBitset")->Apply(setAlgebraSizes);
+BENCHMARK(BM_IntersectAll)->Name("BM_IntersectAll/RuntimeBitset")->Apply(setAlgebraSizes);
+BENCHMARK(BM_UnionAll)->Name("BM_UnionAll/RuntimeBitset")->Apply(setAlgebraSizes);
+BENCHMARK(BM_Threshold)->Name("BM_Threshold/RuntimeBitset")->Apply(setAlgebraSizes);
+BENCHMARK(BM_NearestHamming)->Name("BM_NearestHamming/RuntimeBitset")->Apply(nearestSizes);
+
+// std::bitset needs the size at compile time, one registration per size
+#define RUNTIMEBITSET_BENCH_STD(func, name, bits) \
+  BENCHMARK_TEMPLATE(func, bits)->Name(#name "/std::bitset/" #bits)
+
+#define RUNTIMEBITSET_BENCH_STD_ALL(bits) \
+  RUNTIMEBITSET_BENCH_STD(BM_StdConstruct, BM_Construct, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdCopy, BM_Copy, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdRandomTest, BM_RandomTest, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdRandomSet, BM_RandomSet, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdCount, BM_Count, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdAnd, BM_And, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdOr, BM_Or, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdXor, BM_Xor, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdShiftLeft, BM_ShiftLeft, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdShiftRight, BM_ShiftRight, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdToString, BM_ToString, bits); \
+  RUNTIMEBITSET_BENCH_STD(BM_StdFromString, BM_FromString, bits)
+
+RUNTIMEBITSET_BENCH_STD_ALL(64);
+RUNTIMEBITSET_BENCH_STD_ALL(4096);
+RUNTIMEBITSET_BENCH_STD_ALL(262144);
+static_assert(262144 == MAX_STD_BITS, "update the std::bitset registrations");
+
+BENCHMARK_MAIN();
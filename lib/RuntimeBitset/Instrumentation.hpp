@@ -0,0 +1,181 @@
+/**
+ * Author: AnormalDog (https://github.com/AnormalDog)
+ * Copyright (c) 2025 AnormalDog
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ * header file, opt-in instrumentation of RuntimeBitset: operation counters,
+ *   per operation timing and a hook for external tracers
+ *
+ * Compile with RUNTIMEBITSET_INSTRUMENTATION defined (same value in the library and its users)
+ *   to enable it. Disabled, the macros expand to nothing and there is no cost.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef RUNTIMEBITSET_INSTRUMENTATION
+  #include <atomic>
+  #include <chrono>
+  #include <memory>
+  #include <mutex>
+  #include <vector>
+#endif
+
+namespace DynBitset {
+namespace Instrumentation {
+
+// Operations timed by the instrumentation, used as index of RuntimeBitsetStats::operations
+enum class Operation : std::size_t {
+  Build,        // allocation of the blocks
+  Copy,
+  Move,
+  ToString,
+  FromString,
+  Count,
+  And,          // operator&
+  Or,           // operator|
+  Xor,          // operator^
+  AndAssign,    // operator&=
+  OrAssign,     // operator|=
+  XorAssign,    // operator^=
+  Not,          // operator~
+  ShiftLeft,    // operator<< and operator<<=
+  ShiftRight,   // operator>> and operator>>=
+  IntersectAll, // SetAlgebra
+  UnionAll,
+  Threshold,
+  NearestHamming,
+  NumberOfOperations
+};
+
+constexpr std::size_t NUMBER_OF_OPERATIONS = static_cast<std::size_t>(Operation::NumberOfOperations);
+
+// Returns the name of the operation, nullptr if it is not valid
+inline const char* operationName(const Operation t_operation) noexcept {
+  static const char* const names[NUMBER_OF_OPERATIONS] = {
+    "Build", "Copy", "Move", "ToString", "FromString", "Count", "And", "Or", "Xor",
+    "AndAssign", "OrAssign", "XorAssign", "Not", "ShiftLeft", "ShiftRight",
+    "IntersectAll", "UnionAll", "Threshold", "NearestHamming"
+  };
+  const std::size_t index = static_cast<std::size_t>(t_operation);
+  return (index < NUMBER_OF_OPERATIONS) ? names[index] : nullptr;
+}
+
+struct OperationStats {
+  std::uint64_t calls = 0;
+  std::uint64_t nanoseconds = 0;
+};
+
+// Counters of the calling thread
+struct RuntimeBitsetStats {
+  std::uint64_t allocations = 0; // new[] calls
+  std::uint64_t bytesAllocated = 0;
+  std::uint64_t copies = 0; // copy construction and assignment
+  std::uint64_t moves = 0; // move construction and assignment
+  std::uint64_t temporaries = 0; // bitsets returned by value from &, |, ^, ~, << and >>
+  std::uint64_t wordsProcessed = 0; // blocks touched by bulk operations
+  std::uint64_t bytesStringified = 0; // characters produced by to_string
+  OperationStats operations[NUMBER_OF_OPERATIONS];
+
+  const OperationStats& operator[](const Operation t_operation) const noexcept {
+    return operations[static_cast<std::size_t>(t_operation)];
+  }
+};
+
+// Event sent to the trace hook at the end of every timed operation
+struct TraceEvent {
+  Operation operation;
+  std::size_t bits; // size of the bitset the operation worked on
+  std::uint64_t nanoseconds;
+};
+
+using TraceHook = void (*)(const TraceEvent& t_event, void* t_userData);
+
+#ifdef RUNTIMEBITSET_INSTRUMENTATION
+
+// Function local statics, so there is one instance in header-only mode too
+inline RuntimeBitsetStats& threadStats() noexcept {
+  static thread_local RuntimeBitsetStats stats;
+  return stats;
+}
+
+// The hook and its user data are published together, a tracing thread never sees the
+//   hook of one setTraceHook() call with the user data of another
+struct TraceHookEntry {
+  const TraceHook hook;
+  void* const userData;
+};
+
+struct TraceHookSlot {
+  std::atomic<const TraceHookEntry*> current{nullptr};
+  // Replaced entries are never freed, a thread can still be calling them. Installing
+  //   a hook is rare, so they are kept alive until the end of the program
+  std::mutex mutex;
+  std::vector<std::unique_ptr<const TraceHookEntry>> entries;
+};
+
+inline TraceHookSlot& traceHookSlot() noexcept {
+  static TraceHookSlot slot;
+  return slot;
+}
+
+// Stats of the calling thread since its start or the last resetStats()
+inline const RuntimeBitsetStats& getStats() noexcept {return threadStats();}
+
+inline void resetStats() noexcept {threadStats() = RuntimeBitsetStats();}
+
+// Installs a process wide hook, called from the thread doing the operation. nullptr removes it
+// Calls already in flight finish with the previous hook and user data, so t_userData must
+//   outlive them, also after it is replaced or removed with setTraceHook(nullptr)
+inline void setTraceHook(const TraceHook t_hook, void* t_userData = nullptr) {
+  TraceHookSlot& slot = traceHookSlot();
+  const TraceHookEntry* entry = nullptr;
+  if (t_hook != nullptr) {
+    const std::lock_guard<std::mutex> lock(slot.mutex);
+    slot.entries.emplace_back(new TraceHookEntry{t_hook, t_userData});
+    entry = slot.entries.back().get();
+  }
+  slot.current.store(entry, std::memory_order_release);
+}
+
+// Times the enclosing scope and records it in the stats of the calling thread
+class ScopedTrace {
+  public:
+    ScopedTrace(const Operation t_operation, const std::size_t t_bits) noexcept
+      : m_operation(t_operation), m_bits(t_bits), m_start(std::chrono::steady_clock::now()) {}
+    ~ScopedTrace() {
+      const std::uint64_t elapsed = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count());
+      OperationStats& stats = threadStats().operations[static_cast<std::size_t>(m_operation)];
+      ++stats.calls;
+      stats.nanoseconds += elapsed;
+      const TraceHookEntry* entry = traceHookSlot().current.load(std::memory_order_acquire);
+      if (entry != nullptr) entry->hook(TraceEvent{m_operation, m_bits, elapsed}, entry->userData);
+    }
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+  private:
+    Operation m_operation;
+    std::size_t m_bits;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#endif // RUNTIMEBITSET_INSTRUMENTATION
+
+} // namespace Instrumentation
+} // namespace DynBitset
+
+// INTERNAL MACROS
+// RUNTIMEBITSET_COUNT(field, n): adds n to a counter of RuntimeBitsetStats
+// RUNTIMEBITSET_TRACE(operation, bits): times the rest of the enclosing scope
+#ifdef RUNTIMEBITSET_INSTRUMENTATION
+  #define RUNTIMEBITSET_COUNT(field, n) \
+    (::DynBitset::Instrumentation::threadStats().field += static_cast<std::uint64_t>(n))
+  #define RUNTIMEBITSET_TRACE(operation, bits) \
+    const ::DynBitset::Instrumentation::ScopedTrace runtimeBitsetTrace_( \
+      ::DynBitset::Instrumentation::Operation::operation, (bits))
+#else
+  #define RUNTIMEBITSET_COUNT(field, n) ((void)0)
+  #define RUNTIMEBITSET_TRACE(operation, bits) ((void)0)
+#endif
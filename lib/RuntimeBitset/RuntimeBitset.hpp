@@ -11,9 +11,23 @@
 #include <exception>
 #include <string>
 #include <cstddef>
+#include <istream>
+#include <ostream>
+#include <utility>
+#include "RuntimeBitset/Instrumentation.hpp"
+
+// Header-only mode: the implementation is included at the end of this file and every
+//   out of line definition is marked inline
+#ifdef RUNTIMEBITSET_HEADER_ONLY
+  #define RUNTIMEBITSET_INLINE inline
+#else
+  #define RUNTIMEBITSET_INLINE
+#endif
 
 namespace DynBitset {
 
+namespace Differential {class Invariants;} // test/fuzz/Differential.hpp
+
 class RuntimeBitset {
   public:
     RuntimeBitset(const std::size_t t_size, const std::size_t t_num);
@@ -32,9 +46,10 @@ class RuntimeBitset {
     unsigned long to_ulong() const noexcept;
 
     // Operator acess
-    bool operator[](std::size_t t_position) const;
+    // Hot accessors are defined in this header, so callers can inline them
+    inline bool operator[](std::size_t t_position) const;
 
-    bool test(std::size_t t_position) const;
+    inline bool test(std::size_t t_position) const;
 
     bool all() const noexcept;
     bool any() const noexcept;
@@ -50,17 +65,17 @@ class RuntimeBitset {
  
     // Modifiers
     RuntimeBitset& set() noexcept;
-    RuntimeBitset& set(const std::size_t t_position);
+    inline RuntimeBitset& set(const std::size_t t_position);
     RuntimeBitset& reset() noexcept;
-    RuntimeBitset& reset(const std::size_t t_position);   
+    inline RuntimeBitset& reset(const std::size_t t_position);
     RuntimeBitset& flip() noexcept;
-    RuntimeBitset& flip(const std::size_t t_position);
+    inline RuntimeBitset& flip(const std::size_t t_position);
 
     // Modifiers
     RuntimeBitset& operator&=(const RuntimeBitset& t_other);
     RuntimeBitset& operator|=(const RuntimeBitset& t_other);
     RuntimeBitset& operator^=(const RuntimeBitset& t_other);
-    RuntimeBitset operator~();
+    RuntimeBitset operator~() const;
 
     RuntimeBitset operator<<(std::size_t t_pos) const;
     RuntimeBitset& operator<<=(std::size_t t_pos);
@@ -69,7 +84,7 @@ class RuntimeBitset {
 
     // Binary logic operators
     friend inline RuntimeBitset operator&(const RuntimeBitset& t_1, const RuntimeBitset& t_2);
-    friend inline  RuntimeBitset operator|(const RuntimeBitset& t_1, const RuntimeBitset& t_2);
+    friend inline RuntimeBitset operator|(const RuntimeBitset& t_1, const RuntimeBitset& t_2);
     friend inline RuntimeBitset operator^(const RuntimeBitset& t_1, const RuntimeBitset& t_2);
 
     // iostream operators
@@ -88,17 +103,22 @@ class RuntimeBitset {
         Reference(Reference&&) = default;
         Reference& operator=(Reference&&) = default;
 
-        Reference& operator=(const bool t_value);
+        inline Reference& operator=(const bool t_value);
 
-        operator bool() const;
-        bool operator~() const;
-        Reference& flip();
+        inline operator bool() const;
+        inline bool operator~() const;
+        inline Reference& flip();
       private:
         std::size_t m_position;
         RuntimeBitset& m_bitset;
     };
 
-    Reference operator[](std::size_t t_pos);
+    inline Reference operator[](std::size_t t_pos);
+
+    // N-ary queries over the blocks, see SetAlgebra.hpp
+    friend class SetAlgebra;
+    // Checks of the internal state done by the differential tests
+    friend class Differential::Invariants;
   private:
     std::size_t* m_bits = nullptr; // little endian
     std::size_t* m_mask = nullptr; // little endian
@@ -114,16 +134,17 @@ class RuntimeBitset {
     void buildMask();
     void build(const std::size_t t_size); // Call buildBlocks, buildMask
     void clean(); // Put all bits to 0
+    void cleanTail() noexcept; // Put the no significant bits of the last block to 0
     void destroy(); // Destroy the object
     static void copy(RuntimeBitset& t_copy, const RuntimeBitset& t_toCopy);
     static void move(RuntimeBitset& t_copy, RuntimeBitset& t_toMove);
     static std::size_t getNumberBlocks(const std::size_t t_size) noexcept; // Method to calculate the number of needed blocks
     static std::size_t getLastMask(const std::size_t t_number_bits); // Method to calculate the mask of the last block
     // First block position, second mask position
-    std::pair<std::size_t, std::size_t> getPosition(std::size_t t_position) const;
+    inline std::pair<std::size_t, std::size_t> getPosition(std::size_t t_position) const;
     // Returns the mask position inside a block
-    static std::size_t getMaskPosition(const std::size_t t_position);
-    bool getValueInPosition(std::size_t t_position) const;
+    static inline std::size_t getMaskPosition(const std::size_t t_position) noexcept;
+    inline bool getValueInPosition(std::size_t t_position) const;
     
     // Bitwise methods
     void shiftBlocksLeft(std::size_t t_pos);
@@ -162,8 +183,88 @@ class RuntimeBitsetUnknownChar : public RuntimeBitsetException {
   RuntimeBitsetUnknownChar() : RuntimeBitsetException("Unkown character found") {}
 };
 
-RuntimeBitset operator&(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
+// HOT ACCESSORS
+// Defined here instead of the source file, so single bit access inlines at the call site
+
+// At first, my idea was the .second was t_position (relative position inside the block)
+// But for more comfortable code, I decided the .second was the mask of the relative position
+inline std::pair<std::size_t, std::size_t> RuntimeBitset::getPosition(std::size_t t_position) const {
+  if (t_position >= m_size) throw(RuntimeBitsetOutOfRange());
+  // BLOCK_SIZE is a power of 2, the division and modulo are a shift and a mask
+  return std::make_pair(t_position / BLOCK_SIZE, getMaskPosition(t_position % BLOCK_SIZE));
+}
+
+// Returns a mask with all 0 except in the t_position
+inline std::size_t RuntimeBitset::getMaskPosition(const std::size_t t_position) noexcept {
+  constexpr std::size_t auxMask = 1;
+  return (auxMask << t_position);
+}
+
+inline bool RuntimeBitset::getValueInPosition(std::size_t t_position) const {
+  const std::pair<std::size_t, std::size_t> position(getPosition(t_position));
+  return (m_bits[position.first] & position.second) != 0; // Get all 0 and the value in t_position
+}
+
+inline bool RuntimeBitset::operator[](std::size_t t_position) const {
+  return getValueInPosition(t_position);
+}
+
+inline bool RuntimeBitset::test(std::size_t t_position) const {
+  return getValueInPosition(t_position);
+}
+
+inline RuntimeBitset& RuntimeBitset::set(const std::size_t t_position) {
+  const std::pair<std::size_t, std::size_t> position(getPosition(t_position));
+  m_bits[position.first] |= position.second; // will apply X | 1 in the position, the rest X | 0
+  return *this;
+}
+
+inline RuntimeBitset& RuntimeBitset::reset(const std::size_t t_position) {
+  const std::pair<std::size_t, std::size_t> position(getPosition(t_position));
+  m_bits[position.first] &= ~position.second; // will aply X & 0 in the position, the rest X & 1
+  return *this;
+}
+
+inline RuntimeBitset& RuntimeBitset::flip(const std::size_t t_position) {
+  const std::pair<std::size_t, std::size_t> position(getPosition(t_position));
+  m_bits[position.first] ^= position.second; // will apply X ^ 1 in the position, the rest X ^ 0
+  return *this;
+}
+
+inline RuntimeBitset::Reference RuntimeBitset::operator[](std::size_t t_pos) {
+  if (t_pos >= m_size) throw(RuntimeBitsetOutOfRange());
+  return Reference(*this, t_pos);
+}
+
+// REFERENCE
+inline RuntimeBitset::Reference& RuntimeBitset::Reference::operator=(const bool t_value) {
+  if (t_value == true) {
+    m_bitset.set(m_position);
+  }
+  else {
+    m_bitset.reset(m_position);
+  }
+  return *this;
+}
+
+inline RuntimeBitset::Reference::operator bool() const {
+  return m_bitset.getValueInPosition(m_position);
+}
+
+inline bool RuntimeBitset::Reference::operator~() const {
+  return !(m_bitset.getValueInPosition(m_position));
+}
+
+inline RuntimeBitset::Reference& RuntimeBitset::Reference::flip() {
+  m_bitset.flip(m_position);
+  return *this;
+}
+
+inline RuntimeBitset operator&(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
   if (t_1.size() != t_2.size()) throw(RuntimeBitsetSizeDismatch());
+  RUNTIMEBITSET_TRACE(And, t_1.size());
+  RUNTIMEBITSET_COUNT(temporaries, 1);
+  RUNTIMEBITSET_COUNT(wordsProcessed, t_1.m_blocks);
   RuntimeBitset aux(t_1.size());
   for (std::size_t i = 0; i < aux.m_blocks; ++i) {
     // Don´t need to apply mask due it doesn´t affect the significant bits
@@ -172,8 +273,11 @@ RuntimeBitset operator&(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
   return aux;
 }
 
-RuntimeBitset operator|(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
+inline RuntimeBitset operator|(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
   if (t_1.size() != t_2.size()) throw(RuntimeBitsetSizeDismatch());
+  RUNTIMEBITSET_TRACE(Or, t_1.size());
+  RUNTIMEBITSET_COUNT(temporaries, 1);
+  RUNTIMEBITSET_COUNT(wordsProcessed, t_1.m_blocks);
   RuntimeBitset aux(t_1.size());
   for (std::size_t i = 0; i < aux.m_blocks; ++i) {
     // Don´t need to apply mask due it doesn´t affect the significant bits
@@ -182,8 +286,11 @@ RuntimeBitset operator|(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
   return aux;
 }
 
-RuntimeBitset operator^(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
+inline RuntimeBitset operator^(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
   if (t_1.size() != t_2.size()) throw(RuntimeBitsetSizeDismatch());
+  RUNTIMEBITSET_TRACE(Xor, t_1.size());
+  RUNTIMEBITSET_COUNT(temporaries, 1);
+  RUNTIMEBITSET_COUNT(wordsProcessed, t_1.m_blocks);
   RuntimeBitset aux(t_1.size());
   for (std::size_t i = 0; i < aux.m_blocks; ++i) {
     // Don´t need to apply mask due it doesn´t affect the significant bits
@@ -192,12 +299,12 @@ RuntimeBitset operator^(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
   return aux;
 }
 
-std::ostream& operator<<(std::ostream& os, const RuntimeBitset& t_bitset) {
+inline std::ostream& operator<<(std::ostream& os, const RuntimeBitset& t_bitset) {
   os << t_bitset.to_string();
   return os;
 }
 
-std::istream& operator>>(std::istream& is, RuntimeBitset& t_bitset) {
+inline std::istream& operator>>(std::istream& is, RuntimeBitset& t_bitset) {
   std::string aux;
   is >> aux;
   t_bitset.buildFromString(aux);
@@ -205,4 +312,8 @@ std::istream& operator>>(std::istream& is, RuntimeBitset& t_bitset) {
   return is;
 }
 
-} // namespace DynBitset
\ No newline at end of file
+} // namespace DynBitset
+
+#ifdef RUNTIMEBITSET_HEADER_ONLY
+  #include "RuntimeBitset/RuntimeBitset.cpp"
+#endif
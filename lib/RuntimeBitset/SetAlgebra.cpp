@@ -0,0 +1,222 @@
+/**
+ * Author: AnormalDog (https://github.com/AnormalDog)
+ * Copyright (c) 2025 AnormalDog
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ * source file, implementation of the class SetAlgebra, queries across many RuntimeBitset
+ *   of the same size
+ */
+
+#include "RuntimeBitset/SetAlgebra.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace DynBitset {
+
+RUNTIMEBITSET_INLINE RuntimeBitset SetAlgebra::intersect_all(const std::vector<const RuntimeBitset*>& t_bitsets) {
+  const std::size_t size = checkSameSize(t_bitsets);
+  RUNTIMEBITSET_TRACE(IntersectAll, size);
+  RuntimeBitset aux(size);
+  const std::size_t blocks = aux.m_blocks;
+  // Chunk by chunk, so the accumulator stays in cache while every input is applied to it
+  for (std::size_t begin = 0; begin < blocks; begin += CHUNK_BLOCKS) {
+    const std::size_t end = (blocks - begin > CHUNK_BLOCKS) ? begin + CHUNK_BLOCKS : blocks;
+    const std::size_t* first = t_bitsets[0]->m_bits;
+    for (std::size_t i = begin; i < end; ++i) {
+      aux.m_bits[i] = first[i] & aux.m_mask[i]; // RuntimeBitset keeps the no significant bits at 0, the masks are a cheap guard, keep them
+    }
+    RUNTIMEBITSET_COUNT(wordsProcessed, end - begin);
+    for (std::size_t j = 1; j < t_bitsets.size(); ++j) {
+      const std::size_t* bits = t_bitsets[j]->m_bits;
+      std::size_t anySet = 0;
+      for (std::size_t i = begin; i < end; ++i) {
+        aux.m_bits[i] &= bits[i];
+        anySet |= aux.m_bits[i];
+      }
+      RUNTIMEBITSET_COUNT(wordsProcessed, end - begin);
+      if (anySet == 0) break; // the chunk is empty, the rest of inputs can´t set anything
+    }
+  }
+  return aux;
+}
+
+RUNTIMEBITSET_INLINE RuntimeBitset SetAlgebra::union_all(const std::vector<const RuntimeBitset*>& t_bitsets) {
+  const std::size_t size = checkSameSize(t_bitsets);
+  RUNTIMEBITSET_TRACE(UnionAll, size);
+  RuntimeBitset aux(size);
+  const std::size_t blocks = aux.m_blocks;
+  for (std::size_t begin = 0; begin < blocks; begin += CHUNK_BLOCKS) {
+    const std::size_t end = (blocks - begin > CHUNK_BLOCKS) ? begin + CHUNK_BLOCKS : blocks;
+    for (std::size_t j = 0; j < t_bitsets.size(); ++j) {
+      const std::size_t* bits = t_bitsets[j]->m_bits;
+      std::size_t allSet = RuntimeBitset::ALL_BITS_ONE;
+      for (std::size_t i = begin; i < end; ++i) {
+        aux.m_bits[i] |= bits[i] & aux.m_mask[i];
+        allSet &= aux.m_bits[i] | ~aux.m_mask[i]; // the no significant bits count as set
+      }
+      RUNTIMEBITSET_COUNT(wordsProcessed, end - begin);
+      if (allSet == RuntimeBitset::ALL_BITS_ONE) break; // the chunk is full, the rest of inputs can´t add anything
+    }
+  }
+  return aux;
+}
+
+// Bit-sliced counters: plane j holds the bit j of the counter of each of the BLOCK_SIZE positions of a block,
+//   so every input is added to the 64 counters of a block with a few word operations (ripple carry adder)
+// Example with 3 inputs, counting a position with the values 1, 1, 0:
+//   after input 0 -> plane0 = 1, plane1 = 0
+//   after input 1 -> plane0 = 0, plane1 = 1 (carry)
+//   after input 2 -> plane0 = 0, plane1 = 1 -> counter == 2
+RUNTIMEBITSET_INLINE RuntimeBitset SetAlgebra::threshold(const std::vector<const RuntimeBitset*>& t_bitsets, const std::size_t t_k) {
+  const std::size_t size = checkSameSize(t_bitsets);
+  RUNTIMEBITSET_TRACE(Threshold, size);
+  RuntimeBitset aux(size);
+  const std::size_t inputs = t_bitsets.size();
+  if (t_k == 0) { // every bit is set in at least 0 inputs
+    aux.set();
+    return aux;
+  }
+  if (t_k > inputs) return aux; // no bit can reach it
+  if (t_k == 1) return union_all(t_bitsets);
+  if (t_k == inputs) return intersect_all(t_bitsets);
+
+  std::size_t planesNeeded = 0; // bits needed to represent the number of inputs
+  for (std::size_t i = inputs; i != 0; i >>= 1) ++planesNeeded;
+
+  std::size_t planes[RuntimeBitset::BLOCK_SIZE];
+  for (std::size_t i = 0; i < aux.m_blocks; ++i) {
+    for (std::size_t p = 0; p < planesNeeded; ++p) planes[p] = 0;
+    for (std::size_t j = 0; j < inputs; ++j) {
+      std::size_t carry = t_bitsets[j]->m_bits[i];
+      for (std::size_t p = 0; p < planesNeeded && carry != 0; ++p) {
+        const std::size_t nextCarry = planes[p] & carry;
+        planes[p] ^= carry;
+        carry = nextCarry;
+      }
+    }
+    // counter >= t_k, comparing from the most significant plane
+    std::size_t greater = 0;
+    std::size_t equal = RuntimeBitset::ALL_BITS_ONE;
+    for (std::size_t p = planesNeeded; p-- > 0;) {
+      const std::size_t kBit = std::size_t(0) - ((t_k >> p) & 1); // all 1 or all 0
+      greater |= equal & planes[p] & ~kBit;
+      equal &= ~(planes[p] ^ kBit);
+    }
+    aux.m_bits[i] = (greater | equal) & aux.m_mask[i];
+  }
+  RUNTIMEBITSET_COUNT(wordsProcessed, aux.m_blocks * inputs);
+  return aux;
+}
+
+RUNTIMEBITSET_INLINE double SetAlgebra::jaccard(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
+  if (t_1.size() != t_2.size()) throw(RuntimeBitsetSizeDismatch());
+  std::size_t intersection = 0;
+  std::size_t unionCount = 0;
+  for (std::size_t i = 0; i < t_1.m_blocks; ++i) {
+    intersection += popcount(t_1.m_bits[i] & t_2.m_bits[i] & t_1.m_mask[i]);
+    unionCount += popcount((t_1.m_bits[i] | t_2.m_bits[i]) & t_1.m_mask[i]);
+  }
+  RUNTIMEBITSET_COUNT(wordsProcessed, t_1.m_blocks * 2);
+  if (unionCount == 0) return 1.0; // two empty sets are equal
+  return static_cast<double>(intersection) / static_cast<double>(unionCount);
+}
+
+RUNTIMEBITSET_INLINE std::size_t SetAlgebra::hamming(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
+  if (t_1.size() != t_2.size()) throw(RuntimeBitsetSizeDismatch());
+  return boundedHamming(t_1, t_2, std::numeric_limits<std::size_t>::max());
+}
+
+RUNTIMEBITSET_INLINE std::vector<SetAlgebra::Neighbour> SetAlgebra::nearest_hamming(const RuntimeBitset& t_query,
+                                                                                   const std::vector<const RuntimeBitset*>& t_collection,
+                                                                                   const std::size_t t_k) {
+  const std::vector<const RuntimeBitset*> queries(1, &t_query);
+  return nearest_hamming(queries, t_collection, t_k).front();
+}
+
+// Each element of the collection is compared with every query before going to the next one,
+//   so it is read from memory once. Once the heap of a query is full, the distance stops
+//   being computed when it can´t beat the worst neighbour already found
+RUNTIMEBITSET_INLINE std::vector<std::vector<SetAlgebra::Neighbour>> SetAlgebra::nearest_hamming(const std::vector<const RuntimeBitset*>& t_queries,
+                                                                                                 const std::vector<const RuntimeBitset*>& t_collection,
+                                                                                                 const std::size_t t_k) {
+  RUNTIMEBITSET_TRACE(NearestHamming, t_queries.empty() ? 0 : t_queries.front()->size());
+  std::vector<std::vector<Neighbour>> best(t_queries.size());
+  if (t_queries.empty() || t_k == 0) return best;
+  const std::size_t size = t_queries.front()->size();
+  for (std::size_t q = 1; q < t_queries.size(); ++q) {
+    if (t_queries[q]->size() != size) throw(RuntimeBitsetSizeDismatch());
+  }
+  for (std::size_t c = 0; c < t_collection.size(); ++c) {
+    if (t_collection[c]->size() != size) throw(RuntimeBitsetSizeDismatch());
+    for (std::size_t q = 0; q < t_queries.size(); ++q) {
+      std::size_t limit = std::numeric_limits<std::size_t>::max();
+      if (best[q].size() == t_k) {
+        // Visited by increasing index, a tie with the worst can´t replace it
+        const std::size_t worst = best[q].front().second;
+        if (worst == 0) continue;
+        limit = worst - 1;
+      }
+      const std::size_t distance = boundedHamming(*t_queries[q], *t_collection[c], limit);
+      if (distance <= limit) pushNeighbour(best[q], Neighbour(c, distance), t_k);
+    }
+  }
+  for (std::size_t q = 0; q < best.size(); ++q) sortNeighbours(best[q]);
+  return best;
+}
+
+RUNTIMEBITSET_INLINE std::size_t SetAlgebra::popcount(std::size_t t_block) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_popcountll(t_block));
+#else
+  std::size_t numberOfActive = 0;
+  while (t_block != 0) {
+    t_block &= t_block - 1; // remove the less significant bit set
+    ++numberOfActive;
+  }
+  return numberOfActive;
+#endif
+}
+
+RUNTIMEBITSET_INLINE std::size_t SetAlgebra::checkSameSize(const std::vector<const RuntimeBitset*>& t_bitsets) {
+  if (t_bitsets.empty()) throw(RuntimeBitsetEmptyInput());
+  const std::size_t size = t_bitsets.front()->size();
+  for (std::size_t i = 1; i < t_bitsets.size(); ++i) {
+    if (t_bitsets[i]->size() != size) throw(RuntimeBitsetSizeDismatch());
+  }
+  return size;
+}
+
+RUNTIMEBITSET_INLINE std::size_t SetAlgebra::boundedHamming(const RuntimeBitset& t_1, const RuntimeBitset& t_2,
+                                                            const std::size_t t_limit) noexcept {
+  const std::size_t blocks = t_1.m_blocks;
+  std::size_t distance = 0;
+  std::size_t end = 0;
+  for (std::size_t begin = 0; begin < blocks && distance <= t_limit; begin = end) { // stops once it is already worse than needed
+    end = (blocks - begin > LIMIT_CHECK_BLOCKS) ? begin + LIMIT_CHECK_BLOCKS : blocks;
+    for (std::size_t i = begin; i < end; ++i) {
+      distance += popcount((t_1.m_bits[i] ^ t_2.m_bits[i]) & t_1.m_mask[i]);
+    }
+  }
+  RUNTIMEBITSET_COUNT(wordsProcessed, end);
+  return distance;
+}
+
+// Order of the max-heap of neighbours: the worst (greater distance, then greater index) on top
+RUNTIMEBITSET_INLINE bool SetAlgebra::nearerNeighbour(const Neighbour& t_1, const Neighbour& t_2) noexcept {
+  if (t_1.second != t_2.second) return t_1.second < t_2.second;
+  return t_1.first < t_2.first;
+}
+
+RUNTIMEBITSET_INLINE void SetAlgebra::pushNeighbour(std::vector<Neighbour>& t_best, const Neighbour& t_candidate, const std::size_t t_k) {
+  if (t_best.size() == t_k) {
+    std::pop_heap(t_best.begin(), t_best.end(), nearerNeighbour); // remove the worst
+    t_best.pop_back();
+  }
+  t_best.push_back(t_candidate);
+  std::push_heap(t_best.begin(), t_best.end(), nearerNeighbour);
+}
+
+RUNTIMEBITSET_INLINE void SetAlgebra::sortNeighbours(std::vector<Neighbour>& t_best) {
+  std::sort_heap(t_best.begin(), t_best.end(), nearerNeighbour); // ascending distance
+}
+
+} // namespace DynBitset
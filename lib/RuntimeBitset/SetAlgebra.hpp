@@ -0,0 +1,74 @@
+/**
+ * Author: AnormalDog (https://github.com/AnormalDog)
+ * Copyright (c) 2025 AnormalDog
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ * header file, interface of the class SetAlgebra, queries across many RuntimeBitset
+ *   of the same size: N-ary intersection and union, threshold and similarity search
+ */
+
+#pragma once
+
+#include "RuntimeBitset/RuntimeBitset.hpp"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace DynBitset {
+
+class SetAlgebra {
+  public:
+    // (index in the collection, hamming distance)
+    using Neighbour = std::pair<std::size_t, std::size_t>;
+
+    // N-ary operators, without a temporary per input. All the bitsets must have the same size
+    // Bits set in every input, stops reading the inputs of a chunk once it is empty
+    static RuntimeBitset intersect_all(const std::vector<const RuntimeBitset*>& t_bitsets);
+    // Bits set in any input, stops reading the inputs of a chunk once it is full
+    static RuntimeBitset union_all(const std::vector<const RuntimeBitset*>& t_bitsets);
+    // Bits set in at least t_k inputs. threshold(1) is union_all, threshold(size) is intersect_all
+    static RuntimeBitset threshold(const std::vector<const RuntimeBitset*>& t_bitsets, const std::size_t t_k);
+
+    // Similarity between two bitsets of the same size
+    // |a & b| / |a | b|, 1.0 if both are empty
+    static double jaccard(const RuntimeBitset& t_1, const RuntimeBitset& t_2);
+    // Number of different bits
+    static std::size_t hamming(const RuntimeBitset& t_1, const RuntimeBitset& t_2);
+
+    // The t_k bitsets of t_collection nearest to t_query by hamming distance, sorted by distance and index
+    static std::vector<Neighbour> nearest_hamming(const RuntimeBitset& t_query,
+                                                  const std::vector<const RuntimeBitset*>& t_collection,
+                                                  const std::size_t t_k);
+    // Same as above for a batch of queries, each element of the collection is read once for all the queries
+    static std::vector<std::vector<Neighbour>> nearest_hamming(const std::vector<const RuntimeBitset*>& t_queries,
+                                                               const std::vector<const RuntimeBitset*>& t_collection,
+                                                               const std::size_t t_k);
+  private:
+    // STATIC MEMBERS
+    // Number of blocks processed at once, 4 KiB per input keeps a few inputs in L1
+    static constexpr std::size_t CHUNK_BLOCKS = 512;
+    // Blocks between two checks of the limit in boundedHamming, 512 bits, so fingerprints of a few
+    //   hundred bits can already stop early
+    static constexpr std::size_t LIMIT_CHECK_BLOCKS = 8;
+
+    // PRIVATE METHODS
+    static std::size_t popcount(std::size_t t_block) noexcept;
+    // Throws if t_bitsets is empty or the sizes differ, returns the common size
+    static std::size_t checkSameSize(const std::vector<const RuntimeBitset*>& t_bitsets);
+    // Hamming distance, stops once it is greater than t_limit (the returned value is then > t_limit)
+    static std::size_t boundedHamming(const RuntimeBitset& t_1, const RuntimeBitset& t_2, const std::size_t t_limit) noexcept;
+    static bool nearerNeighbour(const Neighbour& t_1, const Neighbour& t_2) noexcept;
+    // Inserts t_candidate in t_best (max-heap by distance, at most t_k elements)
+    static void pushNeighbour(std::vector<Neighbour>& t_best, const Neighbour& t_candidate, const std::size_t t_k);
+    static void sortNeighbours(std::vector<Neighbour>& t_best);
+};
+
+class RuntimeBitsetEmptyInput : public RuntimeBitsetException {
+  public:
+    RuntimeBitsetEmptyInput() : RuntimeBitsetException("No bitsets given") {}
+};
+
+} // namespace DynBitset
+
+#ifdef RUNTIMEBITSET_HEADER_ONLY
+  #include "RuntimeBitset/SetAlgebra.cpp"
+#endif
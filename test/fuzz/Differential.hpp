@@ -0,0 +1,392 @@
+/**
+ * Author: AnormalDog (https://github.com/AnormalDog)
+ * Copyright (c) 2025 AnormalDog
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ * header file, differential harness: decodes a sequence of operations from bytes, runs it on
+ *   RuntimeBitset and on a reference model (std::bitset for some fixed sizes, std::vector<bool>
+ *   otherwise) and checks both give the same results after every operation
+ *
+ * Used by the libFuzzer target (fuzz_runtimebitset.cpp) and by the random test (test_differential.cpp)
+ */
+
+#pragma once
+
+#include "RuntimeBitset/RuntimeBitset.hpp"
+#include "RuntimeBitset/SetAlgebra.hpp"
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace DynBitset {
+namespace Differential {
+
+// Thrown when RuntimeBitset and the model disagree, the message says where
+class Mismatch : public RuntimeBitsetException {
+  public:
+    Mismatch(const std::string& t_message) : RuntimeBitsetException(t_message) {}
+};
+
+// Reads the input bytes, returns 0 once they are exhausted so every input is a valid program
+class Input {
+  public:
+    Input(const std::uint8_t* t_data, const std::size_t t_size) : m_data(t_data), m_size(t_size) {}
+
+    bool empty() const noexcept {return m_position >= m_size;}
+
+    std::uint8_t byte() noexcept {
+      return (m_position < m_size) ? m_data[m_position++] : 0;
+    }
+
+    std::size_t word() noexcept {
+      std::size_t aux = 0;
+      for (std::size_t i = 0; i < sizeof(std::size_t); ++i) aux = (aux << 8) | byte();
+      return aux;
+    }
+
+    std::size_t number(const std::size_t t_max) noexcept { // [0, t_max]
+      const std::size_t aux = (static_cast<std::size_t>(byte()) << 8) | byte();
+      return aux % (t_max + 1);
+    }
+  private:
+    const std::uint8_t* m_data;
+    std::size_t m_size;
+    std::size_t m_position = 0;
+};
+
+// MODELS
+// Same operations as RuntimeBitset, implemented by something known to be right
+
+class VectorModel {
+  public:
+    explicit VectorModel(const std::size_t t_size) : m_bits(t_size, false) {}
+
+    std::size_t size() const noexcept {return m_bits.size();}
+    bool test(const std::size_t t_pos) const {return m_bits[t_pos];}
+    void set(const std::size_t t_pos, const bool t_value = true) {m_bits[t_pos] = t_value;}
+    void flip(const std::size_t t_pos) {m_bits[t_pos] = !m_bits[t_pos];}
+    void setAll() {m_bits.assign(m_bits.size(), true);}
+    void resetAll() {m_bits.assign(m_bits.size(), false);}
+    void flipAll() {m_bits.flip();}
+
+    void shiftLeft(const std::size_t t_pos) {
+      for (std::size_t i = m_bits.size(); i-- > 0;) m_bits[i] = (i >= t_pos) ? m_bits[i - t_pos] : false;
+    }
+    void shiftRight(const std::size_t t_pos) {
+      for (std::size_t i = 0; i < m_bits.size(); ++i) {
+        m_bits[i] = (t_pos < m_bits.size() - i) ? m_bits[i + t_pos] : false;
+      }
+    }
+    void bitAnd(const VectorModel& t_other) {for (std::size_t i = 0; i < size(); ++i) m_bits[i] = m_bits[i] && t_other.m_bits[i];}
+    void bitOr(const VectorModel& t_other) {for (std::size_t i = 0; i < size(); ++i) m_bits[i] = m_bits[i] || t_other.m_bits[i];}
+    void bitXor(const VectorModel& t_other) {for (std::size_t i = 0; i < size(); ++i) m_bits[i] = m_bits[i] != t_other.m_bits[i];}
+
+    std::size_t count() const {
+      std::size_t aux = 0;
+      for (std::size_t i = 0; i < size(); ++i) aux += m_bits[i] ? 1 : 0;
+      return aux;
+    }
+    std::string to_string() const {
+      std::string aux(size(), '0');
+      for (std::size_t i = 0; i < size(); ++i) {
+        if (m_bits[i]) aux[size() - 1 - i] = '1';
+      }
+      return aux;
+    }
+  private:
+    std::vector<bool> m_bits;
+};
+
+template <std::size_t N>
+class BitsetModel {
+  public:
+    explicit BitsetModel(const std::size_t) {}
+
+    std::size_t size() const noexcept {return N;}
+    bool test(const std::size_t t_pos) const {return m_bits.test(t_pos);}
+    void set(const std::size_t t_pos, const bool t_value = true) {m_bits.set(t_pos, t_value);}
+    void flip(const std::size_t t_pos) {m_bits.flip(t_pos);}
+    void setAll() {m_bits.set();}
+    void resetAll() {m_bits.reset();}
+    void flipAll() {m_bits.flip();}
+    void shiftLeft(const std::size_t t_pos) {m_bits <<= t_pos;}
+    void shiftRight(const std::size_t t_pos) {m_bits >>= t_pos;}
+    void bitAnd(const BitsetModel& t_other) {m_bits &= t_other.m_bits;}
+    void bitOr(const BitsetModel& t_other) {m_bits |= t_other.m_bits;}
+    void bitXor(const BitsetModel& t_other) {m_bits ^= t_other.m_bits;}
+    std::size_t count() const {return m_bits.count();}
+    std::string to_string() const {return m_bits.to_string();}
+  private:
+    std::bitset<N> m_bits;
+};
+
+// Internal state RuntimeBitset must keep after every operation, not visible through its interface
+class Invariants {
+  public:
+    // The no significant bits of the last block are 0, the bulk operations rely on it
+    static bool cleanTail(const RuntimeBitset& t_bits) noexcept {
+      if (t_bits.m_blocks == 0) return true;
+      const std::size_t last = t_bits.m_blocks - 1;
+      return (t_bits.m_bits[last] & ~t_bits.m_mask[last]) == 0;
+    }
+};
+
+// HARNESS
+
+constexpr std::size_t POOL_SIZE = 3; // bitsets of the same size the operations choose from
+constexpr std::size_t MAX_OPERATIONS = 256;
+constexpr std::size_t MAX_RANDOM_SIZE = 700; // over 10 blocks
+
+template <typename Model>
+class Runner {
+  public:
+    Runner(const std::size_t t_size, Input& t_input) : m_size(t_size), m_input(t_input) {
+      for (std::size_t i = 0; i < POOL_SIZE; ++i) {
+        m_bitsets.push_back(RuntimeBitset(t_size));
+        m_models.push_back(Model(t_size));
+      }
+    }
+
+    void run() {
+      for (std::size_t step = 0; step < MAX_OPERATIONS && !m_input.empty(); ++step) {
+        m_step = step;
+        const std::size_t target = m_input.byte() % POOL_SIZE;
+        const std::size_t other = m_input.byte() % POOL_SIZE;
+        apply(m_input.byte(), target, other);
+        for (std::size_t i = 0; i < POOL_SIZE; ++i) compare(i);
+      }
+    }
+  private:
+    std::size_t m_size;
+    Input& m_input;
+    std::vector<RuntimeBitset> m_bitsets;
+    std::vector<Model> m_models;
+    std::size_t m_step = 0;
+    std::string m_lastOperation;
+
+    [[noreturn]] void fail(const std::string& t_what) const {
+      std::ostringstream message;
+      message << t_what << " (size " << m_size << ", step " << m_step << ", after " << m_lastOperation << ")";
+      throw Mismatch(message.str());
+    }
+
+    void expect(const bool t_condition, const char* t_what) const {
+      if (!t_condition) fail(t_what);
+    }
+
+    // Shifts around the block boundaries and over the size
+    std::size_t shiftAmount() {
+      const std::size_t kind = m_input.byte() % 4;
+      if (kind == 0) return (m_input.byte() % (m_size / blockSize() + 3)) * blockSize(); // multiple of the block size, up to over the size
+      if (kind == 1) return m_input.number(m_size + 2 * blockSize());
+      if (kind == 2) return m_input.word(); // anything, even SIZE_MAX
+      return m_input.number(blockSize() + 1);
+    }
+
+    static std::size_t blockSize() noexcept {return sizeof(std::size_t) * 8;}
+
+    void apply(const std::uint8_t t_operation, const std::size_t t_target, const std::size_t t_other) {
+      RuntimeBitset& bits = m_bitsets[t_target];
+      Model& model = m_models[t_target];
+      const std::size_t position = m_input.number(m_size - 1);
+      switch (t_operation % 26) {
+        case 0: m_lastOperation = "set(pos)"; bits.set(position); model.set(position); break;
+        case 1: m_lastOperation = "reset(pos)"; bits.reset(position); model.set(position, false); break;
+        case 2: m_lastOperation = "flip(pos)"; bits.flip(position); model.flip(position); break;
+        case 3: m_lastOperation = "set()"; bits.set(); model.setAll(); break;
+        case 4: m_lastOperation = "reset()"; bits.reset(); model.resetAll(); break;
+        case 5: m_lastOperation = "flip()"; bits.flip(); model.flipAll(); break;
+        case 6: m_lastOperation = "operator~"; {
+          const RuntimeBitset aux = ~bits; // the operand is left alone, compare() checks it
+          Model flipped = model;
+          flipped.flipAll();
+          expect(aux.to_string() == flipped.to_string(), "operator~ result");
+          expect(Invariants::cleanTail(aux), "operator~ result no significant bits set");
+          break;
+        }
+        case 7: {
+          const std::size_t shift = shiftAmount();
+          m_lastOperation = "operator<<=(" + std::to_string(shift) + ")";
+          bits <<= shift;
+          model.shiftLeft(shift);
+          break;
+        }
+        case 8: {
+          const std::size_t shift = shiftAmount();
+          m_lastOperation = "operator>>=(" + std::to_string(shift) + ")";
+          bits >>= shift;
+          model.shiftRight(shift);
+          break;
+        }
+        case 9: {
+          const std::size_t shift = shiftAmount();
+          m_lastOperation = "operator<<(" + std::to_string(shift) + ")";
+          bits = m_bitsets[t_other] << shift;
+          model = m_models[t_other];
+          model.shiftLeft(shift);
+          break;
+        }
+        case 10: {
+          const std::size_t shift = shiftAmount();
+          m_lastOperation = "operator>>(" + std::to_string(shift) + ")";
+          bits = m_bitsets[t_other] >> shift;
+          model = m_models[t_other];
+          model.shiftRight(shift);
+          break;
+        }
+        case 11: m_lastOperation = "operator&="; bits &= m_bitsets[t_other]; model.bitAnd(m_models[t_other]); break;
+        case 12: m_lastOperation = "operator|="; bits |= m_bitsets[t_other]; model.bitOr(m_models[t_other]); break;
+        case 13: m_lastOperation = "operator^="; bits ^= m_bitsets[t_other]; model.bitXor(m_models[t_other]); break;
+        case 14: m_lastOperation = "operator&"; {
+          bits = bits & m_bitsets[t_other];
+          model.bitAnd(m_models[t_other]);
+          break;
+        }
+        case 15: m_lastOperation = "operator|"; {
+          bits = bits | m_bitsets[t_other];
+          model.bitOr(m_models[t_other]);
+          break;
+        }
+        case 16: m_lastOperation = "operator^"; {
+          bits = bits ^ m_bitsets[t_other];
+          model.bitXor(m_models[t_other]);
+          break;
+        }
+        case 17: m_lastOperation = "copy assignment"; bits = m_bitsets[t_other]; model = m_models[t_other]; break;
+        case 18: m_lastOperation = "copy constructor"; {
+          RuntimeBitset aux(m_bitsets[t_other]);
+          bits = std::move(aux);
+          model = m_models[t_other];
+          expect(aux.size() == 1 && aux.none(), "moved-from bitset is empty of size 1");
+          break;
+        }
+        case 19: m_lastOperation = "self assignment"; {
+          RuntimeBitset& self = bits;
+          bits = self;
+          bits = std::move(self);
+          break;
+        }
+        case 20: m_lastOperation = "to_string round trip"; bits = RuntimeBitset(bits.to_string()); break;
+        case 21: m_lastOperation = "stream round trip"; {
+          std::stringstream stream;
+          stream << bits;
+          stream >> bits;
+          break;
+        }
+        case 22: m_lastOperation = "Reference"; {
+          const bool value = (m_input.byte() & 1) != 0;
+          bits[position] = value;
+          model.set(position, value);
+          RuntimeBitset::Reference reference = bits[position];
+          reference.flip();
+          model.flip(position);
+          expect(static_cast<bool>(reference) == model.test(position), "Reference value");
+          expect(~reference == !model.test(position), "Reference operator~");
+          break;
+        }
+        case 23: {
+          const std::size_t number = m_input.word();
+          m_lastOperation = "RuntimeBitset(size, " + std::to_string(number) + ")";
+          bits = RuntimeBitset(m_size, number);
+          model.resetAll();
+          for (std::size_t i = 0; i < m_size && i < blockSize(); ++i) {
+            model.set(i, ((number >> i) & 1) != 0);
+          }
+          break;
+        }
+        case 24: m_lastOperation = "out of range"; {
+          bool thrown = false;
+          try {
+            bits.test(m_size + m_input.number(blockSize()));
+          }
+          catch (const RuntimeBitsetOutOfRange&) {
+            thrown = true;
+          }
+          expect(thrown, "out of range access throws");
+          break;
+        }
+        default: m_lastOperation = "SetAlgebra"; checkSetAlgebra(); break;
+      }
+    }
+
+    // Compares the N-ary kernels with the same operations done bit by bit on the models
+    void checkSetAlgebra() {
+      std::vector<const RuntimeBitset*> pointers;
+      for (const RuntimeBitset& i : m_bitsets) pointers.push_back(&i);
+      const std::size_t k = m_input.byte() % (POOL_SIZE + 2);
+      const RuntimeBitset intersection = SetAlgebra::intersect_all(pointers);
+      const RuntimeBitset unionBits = SetAlgebra::union_all(pointers);
+      const RuntimeBitset atLeastK = SetAlgebra::threshold(pointers, k);
+      expect(Invariants::cleanTail(intersection) && Invariants::cleanTail(unionBits) && Invariants::cleanTail(atLeastK),
+             "SetAlgebra result no significant bits set");
+      std::size_t distance = 0;
+      std::size_t bothSet = 0;
+      std::size_t anySet = 0;
+      for (std::size_t i = 0; i < m_size; ++i) {
+        std::size_t inputs = 0;
+        for (const Model& model : m_models) inputs += model.test(i) ? 1 : 0;
+        expect(intersection.test(i) == (inputs == POOL_SIZE), "SetAlgebra::intersect_all");
+        expect(unionBits.test(i) == (inputs != 0), "SetAlgebra::union_all");
+        expect(atLeastK.test(i) == (inputs >= k), "SetAlgebra::threshold");
+        distance += (m_models[0].test(i) != m_models[1].test(i)) ? 1 : 0;
+        bothSet += (m_models[0].test(i) && m_models[1].test(i)) ? 1 : 0;
+        anySet += (m_models[0].test(i) || m_models[1].test(i)) ? 1 : 0;
+      }
+      expect(SetAlgebra::hamming(m_bitsets[0], m_bitsets[1]) == distance, "SetAlgebra::hamming");
+      const double jaccard = (anySet == 0) ? 1.0 : static_cast<double>(bothSet) / static_cast<double>(anySet);
+      expect(SetAlgebra::jaccard(m_bitsets[0], m_bitsets[1]) == jaccard, "SetAlgebra::jaccard");
+      const std::vector<SetAlgebra::Neighbour> nearest = SetAlgebra::nearest_hamming(m_bitsets[0], pointers, 2);
+      expect(nearest.size() == 2 && nearest[0].second == 0, "SetAlgebra::nearest_hamming");
+    }
+
+    // Every observable value of the bitset against the model
+    void compare(const std::size_t t_index) const {
+      const RuntimeBitset& bits = m_bitsets[t_index];
+      const Model& model = m_models[t_index];
+      expect(bits.size() == model.size(), "size");
+      expect(Invariants::cleanTail(bits), "no significant bits of the last block set");
+      const std::string expected = model.to_string();
+      if (bits.to_string() != expected) fail("to_string: " + bits.to_string() + " != " + expected);
+      const std::size_t count = model.count();
+      expect(bits.count() == count, "count");
+      expect(bits.all() == (count == m_size), "all");
+      expect(bits.any() == (count != 0), "any");
+      expect(bits.none() == (count == 0), "none");
+      std::size_t lowBits = 0;
+      for (std::size_t i = 0; i < m_size && i < blockSize(); ++i) {
+        if (model.test(i)) lowBits |= std::size_t(1) << i;
+      }
+      expect(bits.to_ullong() == lowBits, "to_ullong");
+      expect(bits.to_ulong() == static_cast<unsigned long>(lowBits), "to_ulong");
+      for (std::size_t i = 0; i < m_size; ++i) {
+        if (bits.test(i) != model.test(i) || bits[i] != model.test(i)) fail("test(" + std::to_string(i) + ")");
+      }
+    }
+};
+
+// Runs a program: the first bytes choose the size, the rest are operations
+// Sizes with a std::bitset model cover the block boundaries, the rest use std::vector<bool>
+inline void runProgram(const std::uint8_t* t_data, const std::size_t t_size) {
+  Input input(t_data, t_size);
+  const std::size_t kind = input.byte() % 8;
+  switch (kind) {
+    case 0: {Runner<BitsetModel<1>> runner(1, input); runner.run(); break;}
+    case 1: {Runner<BitsetModel<63>> runner(63, input); runner.run(); break;}
+    case 2: {Runner<BitsetModel<64>> runner(64, input); runner.run(); break;}
+    case 3: {Runner<BitsetModel<65>> runner(65, input); runner.run(); break;}
+    case 4: {Runner<BitsetModel<128>> runner(128, input); runner.run(); break;}
+    case 5: {Runner<BitsetModel<200>> runner(200, input); runner.run(); break;}
+    default: {
+      const std::size_t size = 1 + input.number(MAX_RANDOM_SIZE - 1);
+      Runner<VectorModel> runner(size, input);
+      runner.run();
+      break;
+    }
+  }
+}
+
+} // namespace Differential
+} // namespace DynBitset
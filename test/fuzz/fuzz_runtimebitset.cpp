@@ -0,0 +1,26 @@
+/**
+ * Author: AnormalDog (https://github.com/AnormalDog)
+ * Copyright (c) 2025 AnormalDog
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ *
+ * libFuzzer target, runs the differential harness over the fuzzer input
+ */
+
+
+// clang++ -g -O1 -fsanitize=fuzzer,address,undefined -DRUNTIMEBITSET_HEADER_ONLY -I lib/ -I test/ test/fuzz/fuzz_runtimebitset.cpp
+// ./a.out -max_len=2048
+
+#include "fuzz/Differential.hpp"
+#include <cstdlib>
+#include <iostream>
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* t_data, std::size_t t_size) {
+  try {
+    DynBitset::Differential::runProgram(t_data, t_size);
+  }
+  catch (const DynBitset::Differential::Mismatch& e) {
+    std::cerr << "MISMATCH: " << e.what() << std::endl;
+    std::abort(); // libFuzzer saves the input as a crash
+  }
+  return 0;
+}
@@ -0,0 +1,44 @@
+/**
+ * Author: AnormalDog (https://github.com/AnormalDog)
+ * Copyright (c) 2025 AnormalDog
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ *
+ * test file, runs the differential harness (test/fuzz/Differential.hpp) over random programs,
+ *   for compilers without libFuzzer. Usage: test_differential [programs] [seed]
+ */
+
+
+// g++ -Wall -Wextra -Werror -fsanitize=address,undefined -I lib/ -I test/ -g lib/RuntimeBitset/RuntimeBitset.cpp lib/RuntimeBitset/SetAlgebra.cpp test/test_differential.cpp
+
+#include "fuzz/Differential.hpp"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace DynBitset;
+
+int main(int argc, char* argv[]) {
+  const std::size_t programs = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 2000;
+  const std::uint64_t seed = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 2025;
+  std::mt19937_64 gen(seed);
+  std::vector<std::uint8_t> program;
+
+  for (std::size_t i = 0; i < programs; ++i) {
+    program.resize(1 + gen() % 2048);
+    for (std::uint8_t& byte : program) byte = static_cast<std::uint8_t>(gen());
+    try {
+      Differential::runProgram(program.data(), program.size());
+    }
+    catch (const Differential::Mismatch& e) {
+      std::cerr << "MISMATCH in program " << i << " (seed " << seed << "): " << e.what() << std::endl;
+      std::cerr << "program:";
+      for (const std::uint8_t byte : program) std::cerr << ' ' << std::hex << std::setw(2) << std::setfill('0') << static_cast<unsigned>(byte);
+      std::cerr << std::endl;
+      return 1;
+    }
+  }
+  std::cout << programs << " programs OK" << std::endl;
+  return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * Author: AnormalDog (https://github.com/AnormalDog)
+ * Copyright (c) 2025 AnormalDog
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ *
+ * test file used for testing the instrumentation of RuntimeBitset
+ */
+
+
+// g++ -Wall -Wextra -Werror -I lib/ -DRUNTIMEBITSET_HEADER_ONLY -DRUNTIMEBITSET_INSTRUMENTATION -g test/test_instrumentation.cpp -pthread
+
+#include "RuntimeBitset/RuntimeBitset.hpp"
+#include "RuntimeBitset/SetAlgebra.hpp"
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace DynBitset;
+using namespace DynBitset::Instrumentation;
+
+namespace {
+
+int failures = 0;
+
+void check(const bool t_condition, const char* t_message) {
+  if (!t_condition) {
+    std::cerr << "FAILED: " << t_message << std::endl;
+    ++failures;
+  }
+}
+
+struct HookCounter {
+  std::size_t events = 0;
+  std::size_t countEvents = 0;
+  std::size_t lastBits = 0;
+};
+
+void hook(const TraceEvent& t_event, void* t_userData) {
+  HookCounter* counter = static_cast<HookCounter*>(t_userData);
+  ++counter->events;
+  if (t_event.operation == Operation::Count) {
+    ++counter->countEvents;
+    counter->lastBits = t_event.bits;
+  }
+}
+
+// Each hook must always receive its own user data, even while another thread replaces it
+std::atomic<std::size_t> mismatchedUserData{0};
+int tagA = 0;
+int tagB = 0;
+
+void hookA(const TraceEvent&, void* t_userData) {
+  if (t_userData != &tagA) ++mismatchedUserData;
+}
+
+void hookB(const TraceEvent&, void* t_userData) {
+  if (t_userData != &tagB) ++mismatchedUserData;
+}
+
+} // namespace
+
+int main() {
+  resetStats();
+  RuntimeBitset one(130); // 3 blocks
+  check(getStats().allocations == 2, "construction allocates the bits and the mask");
+  check(getStats().bytesAllocated == 2 * 3 * sizeof(std::size_t), "bytes allocated by the construction");
+  check(getStats()[Operation::Build].calls == 1, "one build");
+
+  RuntimeBitset two(one);
+  check(getStats().copies == 1, "copy constructor counted");
+  check(getStats().allocations == 4, "copy allocates");
+
+  RuntimeBitset three = one & two;
+  check(getStats().temporaries == 1, "operator& creates a temporary");
+  check(getStats()[Operation::And].calls == 1, "operator& timed");
+
+  const std::uint64_t allocations = getStats().allocations;
+  three &= one;
+  three |= one;
+  three ^= one;
+  check(getStats().temporaries == 1, "compound operators don´t create temporaries");
+  check(getStats().allocations == allocations, "compound operators don´t allocate");
+  check(getStats()[Operation::XorAssign].calls == 1, "operator^= timed");
+
+  three.to_string();
+  check(getStats().bytesStringified == 130, "to_string bytes");
+
+  HookCounter counter;
+  setTraceHook(&hook, &counter);
+  three.count();
+  setTraceHook(nullptr);
+  three.count();
+  check(counter.countEvents == 1 && counter.lastBits == 130, "trace hook called for count");
+  check(getStats()[Operation::Count].calls == 2, "count timed");
+
+  std::atomic<bool> tracing{true};
+  std::vector<std::thread> tracers;
+  for (std::size_t i = 0; i < 2; ++i) {
+    tracers.emplace_back([&tracing]() {
+      const RuntimeBitset local(130);
+      while (tracing.load()) local.count();
+    });
+  }
+  for (std::size_t i = 0; i < 2000; ++i) {
+    if (i % 2 == 0) setTraceHook(&hookA, &tagA);
+    else setTraceHook(&hookB, &tagB);
+  }
+  setTraceHook(nullptr);
+  tracing = false;
+  for (std::thread& i : tracers) i.join();
+  check(mismatchedUserData == 0, "hook and user data replaced together");
+
+  RuntimeBitset early(130); // 3 blocks, the first one decides
+  early.set(0);
+  std::uint64_t visited = getStats().wordsProcessed;
+  early.any();
+  early.none();
+  early.all();
+  check(getStats().wordsProcessed - visited == 3, "all, any and none count only the blocks visited");
+  early.reset();
+  visited = getStats().wordsProcessed;
+  early.any();
+  check(getStats().wordsProcessed - visited == 3, "any of an empty bitset visits every block");
+
+  // 1024 bits (16 blocks): the candidate that can´t beat the nearest one stops after the first blocks
+  const RuntimeBitset query(1024);
+  std::vector<RuntimeBitset> collection(1, RuntimeBitset(1024));
+  collection[0].set(1000); // distance 1
+  collection.push_back(RuntimeBitset(1024));
+  collection[1].set(); // distance 1024
+  const std::vector<const RuntimeBitset*> candidates = {&collection[0], &collection[1]};
+  const std::uint64_t words = getStats().wordsProcessed;
+  SetAlgebra::nearest_hamming(query, candidates, 1);
+  check(getStats().wordsProcessed - words == 16 + 8, "nearest_hamming stops a candidate early");
+
+  std::uint64_t otherThreadCopies = 1;
+  std::thread other([&otherThreadCopies]() {otherThreadCopies = getStats().copies;});
+  other.join();
+  check(otherThreadCopies == 0, "stats are per thread");
+
+  resetStats();
+  check(getStats().copies == 0 && getStats()[Operation::Count].calls == 0, "reset clears the stats");
+
+  if (failures == 0) std::cout << "instrumentation OK" << std::endl;
+  return failures == 0 ? 0 : 1;
+}
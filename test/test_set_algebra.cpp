@@ -0,0 +1,141 @@
+/**
+ * Author: AnormalDog (https://github.com/AnormalDog)
+ * Copyright (c) 2025 AnormalDog
+ * Licensed under the MIT License. See LICENSE file in the project root for full license information.
+ *
+ * test file used for testing SetAlgebra against a bit by bit reference
+ */
+
+
+// g++ -Wall -Wextra -Werror -I lib/ -g lib/RuntimeBitset/RuntimeBitset.cpp lib/RuntimeBitset/SetAlgebra.cpp test/test_set_algebra.cpp
+
+#include "RuntimeBitset/SetAlgebra.hpp"
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace DynBitset;
+
+namespace {
+
+int failures = 0;
+
+void check(const bool t_condition, const char* t_message, const std::size_t t_size) {
+  if (!t_condition) {
+    std::cerr << "FAILED: " << t_message << " (size " << t_size << ")" << std::endl;
+    ++failures;
+  }
+}
+
+// Density in per mil, low densities make the intersections go empty early
+RuntimeBitset randomBitset(const std::size_t t_size, const unsigned t_density, std::mt19937_64& t_gen) {
+  RuntimeBitset aux(t_size);
+  for (std::size_t i = 0; i < t_size; ++i) {
+    if (t_gen() % 1000 < t_density) aux.set(i);
+  }
+  return aux;
+}
+
+std::size_t inputsWithBit(const std::vector<RuntimeBitset>& t_inputs, const std::size_t t_position) {
+  std::size_t number = 0;
+  for (const RuntimeBitset& i : t_inputs) number += i.test(t_position) ? 1 : 0;
+  return number;
+}
+
+bool sameAsThreshold(const RuntimeBitset& t_result, const std::vector<RuntimeBitset>& t_inputs, const std::size_t t_k) {
+  if (t_result.size() != t_inputs.front().size()) return false;
+  for (std::size_t i = 0; i < t_result.size(); ++i) {
+    if (t_result.test(i) != (inputsWithBit(t_inputs, i) >= t_k)) return false;
+  }
+  return true;
+}
+
+std::size_t referenceHamming(const RuntimeBitset& t_1, const RuntimeBitset& t_2) {
+  std::size_t distance = 0;
+  for (std::size_t i = 0; i < t_1.size(); ++i) distance += (t_1.test(i) != t_2.test(i)) ? 1 : 0;
+  return distance;
+}
+
+void testQueries(const std::size_t t_size, const unsigned t_density, std::mt19937_64& t_gen) {
+  std::vector<RuntimeBitset> inputs;
+  for (std::size_t i = 0; i < 7; ++i) inputs.push_back(randomBitset(t_size, t_density, t_gen));
+  // same value, rebuilt through flip() and operator~, which must clean the no significant bits of the
+  //   last block they set (test_differential checks it after every operation)
+  inputs[3].flip();
+  for (std::size_t i = 0; i < inputs[3].size(); ++i) inputs[3].flip(i);
+  inputs[3] = ~~inputs[3];
+
+  std::vector<const RuntimeBitset*> pointers;
+  for (const RuntimeBitset& i : inputs) pointers.push_back(&i);
+
+  RuntimeBitset chainedAnd = inputs[0];
+  RuntimeBitset chainedOr = inputs[0];
+  for (std::size_t i = 1; i < inputs.size(); ++i) {
+    chainedAnd &= inputs[i];
+    chainedOr |= inputs[i];
+  }
+  check(SetAlgebra::intersect_all(pointers).to_string() == chainedAnd.to_string(), "intersect_all", t_size);
+  check(SetAlgebra::union_all(pointers).to_string() == chainedOr.to_string(), "union_all", t_size);
+  for (std::size_t k = 0; k <= inputs.size() + 1; ++k) {
+    check(sameAsThreshold(SetAlgebra::threshold(pointers, k), inputs, k), "threshold", t_size);
+  }
+
+  const std::size_t distance = referenceHamming(inputs[0], inputs[1]);
+  check(SetAlgebra::hamming(inputs[0], inputs[1]) == distance, "hamming", t_size);
+  const std::size_t intersection = (inputs[0] & inputs[1]).count();
+  const std::size_t unionCount = (inputs[0] | inputs[1]).count();
+  const double jaccard = (unionCount == 0) ? 1.0 : static_cast<double>(intersection) / static_cast<double>(unionCount);
+  check(SetAlgebra::jaccard(inputs[0], inputs[1]) == jaccard, "jaccard", t_size);
+
+  // nearest: the query is inputs[2], so the first neighbour is at distance 0 (itself, or an equal one with lower index)
+  const std::vector<SetAlgebra::Neighbour> nearest = SetAlgebra::nearest_hamming(inputs[2], pointers, 3);
+  check(nearest.size() == 3 && nearest[0].first <= 2 && nearest[0].second == 0, "nearest_hamming itself", t_size);
+  for (std::size_t i = 0; i < nearest.size(); ++i) {
+    check(nearest[i].second == referenceHamming(inputs[2], inputs[nearest[i].first]), "nearest_hamming distance", t_size);
+    if (i > 0) check(nearest[i - 1].second <= nearest[i].second, "nearest_hamming order", t_size);
+  }
+  // nothing left out is nearer than the last one returned
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    bool returned = false;
+    for (const SetAlgebra::Neighbour& n : nearest) returned = returned || (n.first == i);
+    if (!returned) check(referenceHamming(inputs[2], inputs[i]) >= nearest.back().second, "nearest_hamming top-k", t_size);
+  }
+  const std::vector<std::vector<SetAlgebra::Neighbour>> batch = SetAlgebra::nearest_hamming(pointers, pointers, 3);
+  check(batch.size() == inputs.size() && batch[2] == nearest, "batch nearest_hamming", t_size);
+}
+
+} // namespace
+
+int main() {
+  std::mt19937_64 gen(2025);
+  // sizes around the block size and over a chunk (512 blocks), sparse and dense
+  const std::size_t sizes[] = {1, 63, 64, 65, 1000, 40000};
+  for (const std::size_t size : sizes) {
+    testQueries(size, 20, gen);
+    testQueries(size, 500, gen);
+    testQueries(size, 980, gen);
+  }
+
+  bool thrown = false;
+  try {
+    SetAlgebra::intersect_all(std::vector<const RuntimeBitset*>());
+  }
+  catch (const RuntimeBitsetEmptyInput&) {
+    thrown = true;
+  }
+  check(thrown, "empty input throws", 0);
+
+  thrown = false;
+  const RuntimeBitset one(10);
+  const RuntimeBitset two(11);
+  try {
+    SetAlgebra::union_all(std::vector<const RuntimeBitset*>{&one, &two});
+  }
+  catch (const RuntimeBitsetSizeDismatch&) {
+    thrown = true;
+  }
+  check(thrown, "different sizes throw", 0);
+
+  if (failures == 0) std::cout << "set algebra OK" << std::endl;
+  return failures == 0 ? 0 : 1;
+}